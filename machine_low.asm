@@ -15,4 +15,17 @@ global _get_EFLAGS
 _get_EFLAGS:
 	pushfd			; push eflags
 	pop	eax		; pop contents into eax
+	ret
+
+; ----------------------------------------------------------------------
+; read_tsc()
+;
+; Returns the 64-bit time-stamp counter (in edx:eax, as the C calling
+; convention expects for an unsigned long long).
+;
+; ----------------------------------------------------------------------
+global _read_tsc
+; this function is exported.
+_read_tsc:
+	rdtsc			; edx:eax = time-stamp counter
 	ret
\ No newline at end of file